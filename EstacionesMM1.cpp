@@ -0,0 +1,116 @@
+/**
+ * @archivo EstacionesMM1.cpp
+ * @brief Lógica de llegada, salida y acumuladores de las estaciones de una red de colas.
+ *
+ * La programación de los eventos de salida queda a cargo de quien invoca estos métodos: SimulacionMM1 usa su
+ * arreglo tiempoProximoEvento y SimulacionRedJackson una única lista de eventos compartida por todas las estaciones.
+ */
+
+#include "EstacionesMM1.h"
+
+constexpr int OCUPADO = 1;
+constexpr int LIBRE = 0;
+
+/**
+ * @brief El constructor de EstacionesMM1.
+ *
+ * @param numEstaciones La cantidad de estaciones de la red.
+ */
+EstacionesMM1::EstacionesMM1(int numEstaciones)
+        : numEnCola(numEstaciones), estadoServidor(numEstaciones), numClientesEsperando(numEstaciones),
+          areaNumEnCola(numEstaciones), areaEstadoServidor(numEstaciones), totalDeEsperas(numEstaciones),
+          tiempoUltimoEvento(numEstaciones), ultimaDemora(numEstaciones), tiempoLlegada(numEstaciones) {
+    inicializar();
+}
+
+/**
+ * @brief Deja todas las estaciones libres, con la cola vacía y los contadores estadísticos en cero.
+ */
+void EstacionesMM1::inicializar() {
+    for (int i = 0; i < numEstaciones(); ++i) {
+        estadoServidor[i] = LIBRE;
+        numEnCola[i] = 0;
+        tiempoUltimoEvento[i] = 0.0;
+
+        numClientesEsperando[i] = 0;
+        totalDeEsperas[i] = 0.0;
+        areaNumEnCola[i] = 0.0;
+        areaEstadoServidor[i] = 0.0;
+        ultimaDemora[i] = 0.0;
+        tiempoLlegada[i].clear();
+    }
+}
+
+/**
+ * @brief Gestiona la llegada de un cliente a una estación.
+ *
+ * Si el servidor está ocupado, el cliente entra a la cola. Si el servidor está libre, el cliente pasa a servicio
+ * con demora cero.
+ *
+ * @param estacion La estación a la que llega el cliente.
+ * @param tiempoSimulacion El instante de la llegada.
+ * @return true si el cliente inicia servicio y se debe programar su salida.
+ */
+bool EstacionesMM1::llegada(int estacion, double tiempoSimulacion) {
+    actEstadisticasTiempoProm(estacion, tiempoSimulacion);
+
+    if (estadoServidor[estacion] == OCUPADO) {
+        ++numEnCola[estacion];
+        tiempoLlegada[estacion].push_back(tiempoSimulacion);
+        return false;
+    }
+
+    ultimaDemora[estacion] = 0.0;
+    ++numClientesEsperando[estacion];
+    estadoServidor[estacion] = OCUPADO;
+    return true;
+}
+
+/**
+ * @brief Gestiona la salida de un cliente de una estación.
+ *
+ * Si la cola está vacía, el servidor queda libre. En otro caso, el primer cliente de la cola pasa a servicio y
+ * se acumula su demora.
+ *
+ * @param estacion La estación de la que sale el cliente.
+ * @param tiempoSimulacion El instante de la salida.
+ * @return true si otro cliente inicia servicio y se debe programar su salida.
+ */
+bool EstacionesMM1::salida(int estacion, double tiempoSimulacion) {
+    actEstadisticasTiempoProm(estacion, tiempoSimulacion);
+
+    if (numEnCola[estacion] == 0) {
+        estadoServidor[estacion] = LIBRE;
+        return false;
+    }
+
+    --numEnCola[estacion];
+
+    ultimaDemora[estacion] = tiempoSimulacion - tiempoLlegada[estacion].front();
+    totalDeEsperas[estacion] += ultimaDemora[estacion];
+    tiempoLlegada[estacion].pop_front();
+
+    ++numClientesEsperando[estacion];
+    return true;
+}
+
+/**
+ * @brief Actualiza los acumuladores de área de una estación hasta el instante dado.
+ *
+ * @param estacion La estación a actualizar.
+ * @param tiempoSimulacion El instante actual de la simulación.
+ */
+void EstacionesMM1::actEstadisticasTiempoProm(int estacion, double tiempoSimulacion) {
+    double timeSinceLastEvent = tiempoSimulacion - tiempoUltimoEvento[estacion];
+    tiempoUltimoEvento[estacion] = tiempoSimulacion;
+
+    areaNumEnCola[estacion] += static_cast<double>(numEnCola[estacion]) * timeSinceLastEvent;
+    areaEstadoServidor[estacion] += static_cast<double>(estadoServidor[estacion]) * timeSinceLastEvent;
+}
+
+/**
+ * @brief Devuelve la cantidad de estaciones.
+ */
+int EstacionesMM1::numEstaciones() const {
+    return static_cast<int>(estadoServidor.size());
+}
@@ -0,0 +1,35 @@
+#ifndef METALLER2_ESTACIONESMM1_H
+#define METALLER2_ESTACIONESMM1_H
+
+#include <deque>
+#include <vector>
+
+/**
+ * @clase EstacionesMM1
+ * @brief Estado de un conjunto de estaciones M/M/1 guardado como estructura de arreglos.
+ *
+ * Contiene la lógica de llegada, salida y acumuladores de una estación de servidor único, compartida por
+ * SimulacionMM1 (una estación) y SimulacionRedJackson (muchas). El estado de todas las estaciones se guarda en
+ * arreglos paralelos indexados por estación. Los acumuladores de área se actualizan solo cuando la estación tiene
+ * un evento, por lo que el costo por evento no depende del número de estaciones.
+ */
+class EstacionesMM1 {
+public:
+    std::vector<int> numEnCola, estadoServidor, numClientesEsperando;
+    std::vector<double> areaNumEnCola, areaEstadoServidor, totalDeEsperas, tiempoUltimoEvento;
+
+    /** Demora en cola del último cliente que pasó a servicio en cada estación. */
+    std::vector<double> ultimaDemora;
+    std::vector<std::deque<double>> tiempoLlegada;
+
+    explicit EstacionesMM1(int numEstaciones);
+
+    void inicializar();
+    bool llegada(int estacion, double tiempoSimulacion);
+    bool salida(int estacion, double tiempoSimulacion);
+    void actEstadisticasTiempoProm(int estacion, double tiempoSimulacion);
+
+    int numEstaciones() const;
+};
+
+#endif //METALLER2_ESTACIONESMM1_H
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <stdexcept>
+
+#include "erlangf.h"
+#include "ResultadoParcial.h"
+
+
+/**
+ * @archivo FusionarResultados.cpp
+ * @brief Herramienta que combina resultados parciales de SimulacionMM1 en un único reporte.
+ *
+ * Cada proceso de METaller2 ejecutado con --semillas y --parcial escribe un resultado parcial con los estadísticos
+ * suficientes de sus réplicas. Esta herramienta los combina sin pérdida y reporta las medias agrupadas con sus
+ * intervalos de confianza del 95%, de modo que las réplicas pueden repartirse entre varios procesos o máquinas
+ * compartiendo solo el sistema de archivos.
+ *
+ * Uso: METaller2Fusion <reporte> <parcial> [<parcial> ...] [--parcial <salida>]
+ *
+ * @fecha octubre de 2026.
+*/
+
+/**
+ * @brief Escribe una fila del reporte con la media agrupada, su intervalo de confianza y el valor teórico.
+ *
+ * Si el valor teórico es NAN, como con un perfil de llegadas no estacionario, la columna teórica se omite.
+ */
+static void reportarMedida(std::ofstream &reporte, const char *nombre, const SumaSuficiente &suma, double teorico) {
+    reporte << "|| " << std::left << std::setw(26) << nombre << std::right << std::setw(12) << suma.media;
+    if (suma.n > 1) {
+        double semiancho = CuantilT975(suma.n - 1) * std::sqrt(suma.varianza() / static_cast<double>(suma.n));
+        reporte << "  +/- " << std::setw(10) << semiancho
+                << "  [" << suma.media - semiancho << " , " << suma.media + semiancho << "]";
+    } else {
+        reporte << "  +/- " << std::setw(10) << "n/a";
+    }
+    if (!std::isnan(teorico)) {
+        reporte << "  teorico: " << teorico;
+    }
+    reporte << "\n";
+}
+
+/**
+ * @brief Escribe el reporte combinado.
+ *
+ * @param ruta La ruta del reporte.
+ * @param total El resultado de combinar todos los parciales.
+ * @param numArchivos La cantidad de archivos combinados.
+ */
+static void reporte(const std::string &ruta, const ResultadoParcial &total, size_t numArchivos) {
+    std::ofstream reporte(ruta);
+    if (!reporte.is_open()) {
+        throw std::runtime_error("No se pudo crear el reporte " + ruta);
+    }
+
+    bool estacionario = total.perfil == SIN_PERFIL;
+    double demora = estacionario ? DemoraPromedioMM1(total.mediaEntreLlegadas, total.mediaServicio) : NAN;
+    double cola = estacionario ? ColaPromedioMM1(total.mediaEntreLlegadas, total.mediaServicio) : NAN;
+    double utilizacion = estacionario ? total.mediaServicio / total.mediaEntreLlegadas : NAN;
+
+    reporte << "=============================================\n";
+    reporte << "|| Modelo de Colas Servidor Unico (Modelo M/M/1) - Resultados combinados\n";
+    reporte << "=============================================\n";
+    if (estacionario) {
+        reporte << "|| Media entre llegadas:   " << std::setw(10) << total.mediaEntreLlegadas << " minutos.\n";
+    }
+    reporte << "|| Media del servicio:     " << std::setw(10) << total.mediaServicio << " minutos.\n";
+    if (estacionario) {
+        reporte << "|| Numero de clientes:     " << std::setw(10) << total.numEsperasRequerido << " clientes.\n";
+    } else {
+        reporte << "|| Perfil de llegadas:      " << total.perfil << "\n";
+    }
+    reporte << "|| Archivos combinados:    " << std::setw(10) << numArchivos << "\n";
+    reporte << "|| Numero de replicas:     " << std::setw(10) << total.numReplicas << "\n";
+    reporte << "|| Semillas:               ";
+    for (const auto &rango: total.rangosSemillas) {
+        reporte << " " << rango.first << "-" << rango.second;
+    }
+    reporte << "\n";
+    reporte << "=============================================\n";
+    reporte << "|| Medias agrupadas e intervalos de confianza del 95%\n";
+    reporte << "=============================================\n";
+    reportarMedida(reporte, "Demora promedio en cola:", total.demoraPromedio, demora);
+    reportarMedida(reporte, "Clientes promedio en cola:", total.colaPromedio, cola);
+    reportarMedida(reporte, "Tasa de uso del servidor:", total.usoServidor, utilizacion);
+    reporte << "=============================================\n";
+    reporte << "|| Histograma de demoras en cola\n";
+    reporte << "=============================================\n";
+    reporte << "Desde , Hasta , Clientes , Fraccion\n";
+
+    long long clientes = 0;
+    size_t ultima = 0;
+    for (size_t i = 0; i < total.cubetasDemora.size(); ++i) {
+        clientes += total.cubetasDemora[i];
+        if (total.cubetasDemora[i] > 0) {
+            ultima = i;
+        }
+    }
+    for (size_t i = 0; i <= ultima && clientes > 0; ++i) {
+        reporte << total.anchoCubeta * static_cast<double>(i) << " , ";
+        if (i + 1 == total.cubetasDemora.size()) {
+            reporte << "inf";
+        } else {
+            reporte << total.anchoCubeta * static_cast<double>(i + 1);
+        }
+        reporte << " , " << total.cubetasDemora[i] << " , "
+                << static_cast<double>(total.cubetasDemora[i]) / static_cast<double>(clientes) << "\n";
+    }
+    reporte << "=============================================\n";
+}
+
+int main(int argc, char *argv[]) {
+    try {
+        std::string rutaReporte, rutaParcial;
+        std::vector<std::string> entradas;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string argumento = argv[i];
+            if (argumento == "--parcial" && i + 1 < argc) {
+                rutaParcial = argv[++i];
+            } else if (rutaReporte.empty()) {
+                rutaReporte = argumento;
+            } else {
+                entradas.push_back(argumento);
+            }
+        }
+        if (rutaReporte.empty() || entradas.empty()) {
+            throw std::invalid_argument("Uso: METaller2Fusion <reporte> <parcial> [<parcial> ...] [--parcial <salida>]");
+        }
+
+        ResultadoParcial total;
+        for (const auto &entrada: entradas) {
+            total.fusionar(LeerResultadoParcial(entrada));
+        }
+
+        reporte(rutaReporte, total, entradas.size());
+        if (!rutaParcial.empty()) {
+            EscribirResultadoParcial(rutaParcial, total);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 3;
+    }
+    return 0;
+}
@@ -0,0 +1,215 @@
+/**
+ * @archivo PerfilLlegadas.cpp
+ * @brief Perfiles de tasa de llegadas no estacionaria y su muestreo por adelgazamiento.
+ *
+ * El archivo de perfil contiene, en orden: el tipo de perfil (0 constante a trozos, 1 lineal a trozos), el ancho
+ * de las ventanas de tiempo del reporte en minutos, el número de puntos y los puntos como pares
+ * "tiempo tasa", con la tasa en clientes por minuto. El último punto marca el fin del horizonte de simulación;
+ * su tasa solo se usa como extremo del último tramo de un perfil lineal.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "lcgrand.h"
+#include "PerfilLlegadas.h"
+
+/**
+ * @brief El constructor de PerfilLlegadas.
+ *
+ * Lee y valida el perfil, y calcula la cota de la tasa en cada segmento.
+ *
+ * @param ruta La ruta del archivo de perfil.
+ */
+PerfilLlegadas::PerfilLlegadas(const std::string &ruta)
+        : tipo(PERFIL_CONSTANTE), anchoVentana(0.0f), segmentoActual(0), candidatos(0), aceptados(0) {
+    std::ifstream archivo(ruta);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir el perfil de llegadas " + ruta);
+    }
+
+    size_t numPuntos = 0;
+    archivo >> tipo >> anchoVentana >> numPuntos;
+    tiempos.resize(numPuntos);
+    tasas.resize(numPuntos);
+    for (size_t k = 0; k < numPuntos; ++k) {
+        archivo >> tiempos[k] >> tasas[k];
+    }
+
+    if (!archivo || numPuntos < 2) {
+        throw std::runtime_error("Perfil de llegadas incompleto: " + ruta);
+    }
+    if (tipo != PERFIL_CONSTANTE && tipo != PERFIL_LINEAL) {
+        throw std::runtime_error("Tipo de perfil de llegadas desconocido");
+    }
+    if (anchoVentana <= 0.0f) {
+        throw std::runtime_error("El ancho de ventana del perfil debe ser positivo");
+    }
+    if (tiempos[0] != 0.0f) {
+        throw std::runtime_error("El perfil de llegadas debe comenzar en el tiempo 0");
+    }
+    for (size_t k = 0; k < numPuntos; ++k) {
+        if (tasas[k] < 0.0f || (k > 0 && tiempos[k] <= tiempos[k - 1])) {
+            throw std::runtime_error("El perfil de llegadas requiere tiempos crecientes y tasas no negativas");
+        }
+    }
+
+    cotas.resize(numPuntos - 1);
+    for (size_t k = 0; k + 1 < numPuntos; ++k) {
+        cotas[k] = tipo == PERFIL_LINEAL ? std::max(tasas[k], tasas[k + 1]) : tasas[k];
+    }
+}
+
+/**
+ * @brief Reinicia el segmento actual y los contadores de candidatos para una nueva réplica.
+ */
+void PerfilLlegadas::reiniciar() {
+    segmentoActual = 0;
+    candidatos = 0;
+    aceptados = 0;
+}
+
+/**
+ * @brief Devuelve el índice del segmento que contiene el instante dado.
+ */
+size_t PerfilLlegadas::segmento(float tiempo) const {
+    auto it = std::upper_bound(tiempos.begin(), tiempos.end(), tiempo);
+    return static_cast<size_t>(it - tiempos.begin()) - 1;
+}
+
+/**
+ * @brief Devuelve el instante en que termina el segmento k.
+ */
+float PerfilLlegadas::finSegmento(size_t k) const {
+    return tiempos[k + 1];
+}
+
+/**
+ * @brief Genera el instante de la siguiente llegada por adelgazamiento.
+ *
+ * Se generan candidatos con la cota del segmento actual. Si un candidato cae después del fin del segmento, se
+ * descarta y se continúa desde el fin del segmento con la cota del siguiente, lo que es válido por la falta de
+ * memoria de la exponencial. Cada candidato dentro del segmento se acepta con probabilidad tasa / cota; con un
+ * perfil constante a trozos esa probabilidad es 1 y no hay rechazos.
+ *
+ * @param tiempo El instante actual de la simulación; debe ser no decreciente entre llamadas.
+ * @param semilla El flujo de LCGrand a usar.
+ * @return El instante de la siguiente llegada, o 1.0e+30 si no hay más llegadas antes del horizonte.
+ */
+float PerfilLlegadas::siguienteLlegada(float tiempo, int semilla) {
+    while (segmentoActual < cotas.size() && tiempo >= finSegmento(segmentoActual)) {
+        ++segmentoActual;
+    }
+
+    while (segmentoActual < cotas.size()) {
+        float cota = cotas[segmentoActual];
+        float fin = finSegmento(segmentoActual);
+
+        if (cota <= 0.0f) {
+            tiempo = fin;
+            ++segmentoActual;
+            continue;
+        }
+
+        tiempo += -std::log(LCGrand(semilla)) / cota;
+
+        if (tiempo >= fin) {
+            tiempo = fin;
+            ++segmentoActual;
+            continue;
+        }
+
+        ++candidatos;
+        if (tipo == PERFIL_CONSTANTE || LCGrand(semilla) * cota <= tasa(tiempo)) {
+            ++aceptados;
+            return tiempo;
+        }
+    }
+    return 1.0e+30;
+}
+
+/**
+ * @brief Devuelve la tasa de llegadas en el instante dado, o cero después del horizonte.
+ */
+float PerfilLlegadas::tasa(float tiempo) const {
+    if (tiempo >= horizonte()) {
+        return tipo == PERFIL_LINEAL && tiempo == horizonte() ? tasas.back() : 0.0f;
+    }
+    size_t k = segmento(tiempo);
+    if (tipo == PERFIL_CONSTANTE) {
+        return tasas[k];
+    }
+    float fraccion = (tiempo - tiempos[k]) / (tiempos[k + 1] - tiempos[k]);
+    return tasas[k] + fraccion * (tasas[k + 1] - tasas[k]);
+}
+
+/**
+ * @brief Devuelve el número esperado de llegadas en un intervalo, es decir, la integral de la tasa.
+ *
+ * @param desde El inicio del intervalo.
+ * @param hasta El fin del intervalo.
+ */
+float PerfilLlegadas::llegadasEsperadas(float desde, float hasta) const {
+    float total = 0.0f;
+    hasta = std::min(hasta, horizonte());
+    for (size_t k = segmento(desde); k < cotas.size() && tiempos[k] < hasta; ++k) {
+        float inicio = std::max(desde, tiempos[k]);
+        float fin = std::min(hasta, finSegmento(k));
+        if (tipo == PERFIL_CONSTANTE) {
+            total += tasas[k] * (fin - inicio);
+        } else {
+            total += 0.5f * (tasa(inicio) + tasa(fin)) * (fin - inicio);
+        }
+    }
+    return total;
+}
+
+int PerfilLlegadas::tipoPerfil() const {
+    return tipo;
+}
+
+/**
+ * @brief Devuelve el fin del horizonte de simulación, el tiempo del último punto del perfil.
+ */
+float PerfilLlegadas::horizonte() const {
+    return tiempos.back();
+}
+
+/**
+ * @brief Devuelve el perfil en una línea: el tipo, el número de puntos y los puntos "tiempo tasa".
+ *
+ * Los valores se escriben con max_digits10 dígitos. El ancho de ventana se omite porque solo afecta al reporte, no a
+ * las llegadas. Los resultados parciales usan la descripción para no fusionar réplicas de perfiles distintos.
+ */
+std::string PerfilLlegadas::descripcion() const {
+    std::ostringstream texto;
+    texto << std::setprecision(std::numeric_limits<float>::max_digits10);
+    texto << tipo << ' ' << tiempos.size();
+    for (size_t k = 0; k < tiempos.size(); ++k) {
+        texto << ' ' << tiempos[k] << ' ' << tasas[k];
+    }
+    return texto.str();
+}
+
+float PerfilLlegadas::ventana() const {
+    return anchoVentana;
+}
+
+size_t PerfilLlegadas::numPuntos() const {
+    return tiempos.size();
+}
+
+/**
+ * @brief Devuelve la fracción de candidatos aceptados en la réplica actual.
+ *
+ * Solo cuentan los candidatos que caen dentro de su segmento; los que lo sobrepasan no son rechazos del
+ * adelgazamiento, así que un perfil constante a trozos siempre reporta 1.
+ */
+double PerfilLlegadas::tasaAceptacion() const {
+    return candidatos > 0 ? static_cast<double>(aceptados) / static_cast<double>(candidatos) : 1.0;
+}
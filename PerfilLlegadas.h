@@ -0,0 +1,49 @@
+#ifndef METALLER2_PERFILLLEGADAS_H
+#define METALLER2_PERFILLLEGADAS_H
+
+#include <string>
+#include <vector>
+
+constexpr int PERFIL_CONSTANTE = 0;
+constexpr int PERFIL_LINEAL = 1;
+
+/**
+ * @clase PerfilLlegadas
+ * @brief Tasa de llegadas variable en el tiempo, constante a trozos o lineal a trozos.
+ *
+ * El perfil se define por puntos (tiempo, tasa) con tiempos crecientes desde 0. Con un perfil constante a trozos
+ * la tasa del punto k rige hasta el punto k + 1; con un perfil lineal a trozos la tasa se interpola entre puntos
+ * consecutivos. El último punto es el horizonte: la simulación termina allí y no hay llegadas después.
+ *
+ * Los tiempos de llegada se generan por adelgazamiento (Lewis-Shedler) con una cota distinta por segmento, de modo
+ * que los rechazos dependen solo de la variación de la tasa dentro de cada segmento y no del pico del día.
+ */
+class PerfilLlegadas {
+private:
+    int tipo;
+    float anchoVentana;
+    std::vector<float> tiempos, tasas, cotas;
+
+    size_t segmentoActual;
+    long long candidatos, aceptados;
+
+    size_t segmento(float tiempo) const;
+    float finSegmento(size_t k) const;
+
+public:
+    explicit PerfilLlegadas(const std::string &ruta);
+
+    void reiniciar();
+    float siguienteLlegada(float tiempo, int semilla);
+    float tasa(float tiempo) const;
+    float llegadasEsperadas(float desde, float hasta) const;
+    float horizonte() const;
+    std::string descripcion() const;
+
+    int tipoPerfil() const;
+    float ventana() const;
+    size_t numPuntos() const;
+    double tasaAceptacion() const;
+};
+
+#endif //METALLER2_PERFILLLEGADAS_H
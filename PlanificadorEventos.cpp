@@ -0,0 +1,35 @@
+/**
+ * @archivo PlanificadorEventos.cpp
+ * @brief Implementación de la lista de eventos compartida de la red de colas.
+ */
+
+#include "PlanificadorEventos.h"
+
+/**
+ * @brief Agrega un evento a la lista de eventos.
+ *
+ * @param tiempo El instante de simulación en que ocurre el evento.
+ * @param tipo El tipo de evento (llegada externa o salida).
+ * @param estacion La estación a la que pertenece el evento.
+ */
+void PlanificadorEventos::programar(double tiempo, int tipo, int estacion) {
+    eventos.push(Evento{tiempo, tipo, estacion});
+}
+
+/**
+ * @brief Extrae el evento más próximo de la lista de eventos.
+ *
+ * @return El evento con el menor tiempo de ocurrencia.
+ */
+Evento PlanificadorEventos::siguiente() {
+    Evento evento = eventos.top();
+    eventos.pop();
+    return evento;
+}
+
+/**
+ * @brief Indica si la lista de eventos está vacía.
+ */
+bool PlanificadorEventos::vacio() const {
+    return eventos.empty();
+}
@@ -0,0 +1,40 @@
+#ifndef METALLER2_PLANIFICADOREVENTOS_H
+#define METALLER2_PLANIFICADOREVENTOS_H
+
+#include <queue>
+#include <vector>
+
+/**
+ * @brief Evento pendiente en la lista de eventos de una red de colas.
+ */
+struct Evento {
+    double tiempo;
+    int tipo;
+    int estacion;
+};
+
+/**
+ * @clase PlanificadorEventos
+ * @brief Lista de eventos compartida por todas las estaciones de una red.
+ *
+ * A diferencia del arreglo tiempoProximoEvento de SimulacionMM1, que se recorre completo en cada llamada al
+ * temporizador, este planificador guarda los eventos en un montículo binario, de modo que programar y extraer
+ * un evento cuesta O(log n) aun con cientos de estaciones.
+ */
+class PlanificadorEventos {
+private:
+    struct PosteriorA {
+        bool operator()(const Evento &a, const Evento &b) const {
+            return a.tiempo > b.tiempo;
+        }
+    };
+
+    std::priority_queue<Evento, std::vector<Evento>, PosteriorA> eventos;
+
+public:
+    void programar(double tiempo, int tipo, int estacion);
+    Evento siguiente();
+    bool vacio() const;
+};
+
+#endif //METALLER2_PLANIFICADOREVENTOS_H
@@ -0,0 +1,278 @@
+/**
+ * @archivo ResultadoParcial.cpp
+ * @brief Lectura, escritura y fusión de archivos de resultados parciales.
+ *
+ * El archivo es de texto, una clave por línea, y comienza con un encabezado con la versión del formato:
+ *
+ *     METALLER2-PARCIAL 3
+ *     modelo <media entre llegadas> <media de servicio> <numero de demoras>
+ *     perfil <descripcion del perfil de llegadas, o "ninguno">
+ *     flujos <numeros aleatorios por replica>
+ *     replicas <numero de replicas>
+ *     semillas <numero de rangos> <inicial> <final> ...
+ *     demora <n> <media> <m2>
+ *     cola <n> <media> <m2>
+ *     uso <n> <media> <m2>
+ *     histograma <ancho de cubeta> <numero de cubetas> <conteo> ...
+ *
+ * Los valores reales se escriben con max_digits10 dígitos para que la lectura recupere exactamente el valor escrito.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+#include "ResultadoParcial.h"
+
+constexpr char ENCABEZADO_PARCIAL[] = "METALLER2-PARCIAL";
+
+/**
+ * @brief Agrega una observación al acumulador con el algoritmo de Welford.
+ *
+ * @param x La observación.
+ */
+void SumaSuficiente::agregar(double x) {
+    ++n;
+    double delta = x - media;
+    media += delta / static_cast<double>(n);
+    m2 += delta * (x - media);
+}
+
+/**
+ * @brief Combina otro acumulador con este.
+ *
+ * @param otra El acumulador a combinar.
+ */
+void SumaSuficiente::fusionar(const SumaSuficiente &otra) {
+    if (otra.n == 0) {
+        return;
+    }
+    if (n == 0) {
+        *this = otra;
+        return;
+    }
+
+    long long total = n + otra.n;
+    double delta = otra.media - media;
+    media += delta * static_cast<double>(otra.n) / static_cast<double>(total);
+    m2 += otra.m2 + delta * delta * static_cast<double>(n) * static_cast<double>(otra.n) / static_cast<double>(total);
+    n = total;
+}
+
+/**
+ * @brief Devuelve la varianza muestral, o cero si hay menos de dos observaciones.
+ */
+double SumaSuficiente::varianza() const {
+    return n > 1 ? m2 / static_cast<double>(n - 1) : 0.0;
+}
+
+/**
+ * @brief Combina otro resultado parcial con este.
+ *
+ * Falla si los dos resultados describen modelos, perfiles de llegadas o histogramas distintos, o si sus rangos de semillas se traslapan,
+ * ya que en ese caso habría réplicas repetidas.
+ *
+ * @param otro El resultado parcial a combinar.
+ */
+void ResultadoParcial::fusionar(const ResultadoParcial &otro) {
+    if (numReplicas == 0 && rangosSemillas.empty()) {
+        *this = otro;
+        return;
+    }
+
+    if (mediaEntreLlegadas != otro.mediaEntreLlegadas || mediaServicio != otro.mediaServicio ||
+        numEsperasRequerido != otro.numEsperasRequerido) {
+        throw std::runtime_error("Los resultados parciales corresponden a modelos distintos");
+    }
+    if (perfil != otro.perfil) {
+        throw std::runtime_error("Los resultados parciales corresponden a perfiles de llegadas distintos");
+    }
+    if (longitudFlujo != otro.longitudFlujo) {
+        throw std::runtime_error("Los resultados parciales usan flujos de numeros aleatorios distintos");
+    }
+    if (anchoCubeta != otro.anchoCubeta || cubetasDemora.size() != otro.cubetasDemora.size()) {
+        throw std::runtime_error("Los resultados parciales tienen histogramas incompatibles");
+    }
+    for (const auto &rango: rangosSemillas) {
+        for (const auto &otroRango: otro.rangosSemillas) {
+            if (rango.first <= otroRango.second && otroRango.first <= rango.second) {
+                throw std::runtime_error("Los resultados parciales tienen rangos de semillas traslapados");
+            }
+        }
+    }
+
+    numReplicas += otro.numReplicas;
+    rangosSemillas.insert(rangosSemillas.end(), otro.rangosSemillas.begin(), otro.rangosSemillas.end());
+    std::sort(rangosSemillas.begin(), rangosSemillas.end());
+
+    std::vector<std::pair<int, int>> contiguos;
+    for (const auto &rango: rangosSemillas) {
+        if (!contiguos.empty() && contiguos.back().second + 1 == rango.first) {
+            contiguos.back().second = rango.second;
+        } else {
+            contiguos.push_back(rango);
+        }
+    }
+    rangosSemillas.swap(contiguos);
+
+    demoraPromedio.fusionar(otro.demoraPromedio);
+    colaPromedio.fusionar(otro.colaPromedio);
+    usoServidor.fusionar(otro.usoServidor);
+
+    for (size_t i = 0; i < cubetasDemora.size(); ++i) {
+        cubetasDemora[i] += otro.cubetasDemora[i];
+    }
+}
+
+static void escribirSuma(std::ofstream &archivo, const char *clave, const SumaSuficiente &suma) {
+    archivo << clave << ' ' << suma.n << ' ' << suma.media << ' ' << suma.m2 << '\n';
+}
+
+static void leerClave(std::ifstream &archivo, const char *clave) {
+    std::string leida;
+    archivo >> leida;
+    if (leida != clave) {
+        throw std::runtime_error(std::string("Se esperaba la clave '") + clave + "' en el resultado parcial");
+    }
+}
+
+static SumaSuficiente leerSuma(std::ifstream &archivo, const char *clave) {
+    SumaSuficiente suma;
+    leerClave(archivo, clave);
+    archivo >> suma.n >> suma.media >> suma.m2;
+    return suma;
+}
+
+/**
+ * @brief Escribe un resultado parcial en disco.
+ *
+ * @param ruta La ruta del archivo a escribir.
+ * @param parcial El resultado parcial.
+ */
+void EscribirResultadoParcial(const std::string &ruta, const ResultadoParcial &parcial) {
+    std::ofstream archivo(ruta);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo crear el resultado parcial " + ruta);
+    }
+    archivo << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    archivo << ENCABEZADO_PARCIAL << ' ' << VERSION_RESULTADO_PARCIAL << '\n';
+    archivo << "modelo " << parcial.mediaEntreLlegadas << ' ' << parcial.mediaServicio << ' '
+            << parcial.numEsperasRequerido << '\n';
+    archivo << "perfil " << parcial.perfil << '\n';
+    archivo << "flujos " << parcial.longitudFlujo << '\n';
+    archivo << "replicas " << parcial.numReplicas << '\n';
+
+    archivo << "semillas " << parcial.rangosSemillas.size();
+    for (const auto &rango: parcial.rangosSemillas) {
+        archivo << ' ' << rango.first << ' ' << rango.second;
+    }
+    archivo << '\n';
+
+    escribirSuma(archivo, "demora", parcial.demoraPromedio);
+    escribirSuma(archivo, "cola", parcial.colaPromedio);
+    escribirSuma(archivo, "uso", parcial.usoServidor);
+
+    archivo << "histograma " << parcial.anchoCubeta << ' ' << parcial.cubetasDemora.size();
+    for (long long conteo: parcial.cubetasDemora) {
+        archivo << ' ' << conteo;
+    }
+    archivo << '\n';
+
+    if (!archivo) {
+        throw std::runtime_error("Error al escribir el resultado parcial " + ruta);
+    }
+}
+
+/**
+ * @brief Lee un resultado parcial desde disco.
+ *
+ * @param ruta La ruta del archivo a leer.
+ * @return El resultado parcial leído.
+ */
+ResultadoParcial LeerResultadoParcial(const std::string &ruta) {
+    std::ifstream archivo(ruta);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo abrir el resultado parcial " + ruta);
+    }
+
+    std::string clave;
+    int version = 0;
+    archivo >> clave >> version;
+    if (clave != ENCABEZADO_PARCIAL) {
+        throw std::runtime_error(ruta + " no es un resultado parcial");
+    }
+    if (version != VERSION_RESULTADO_PARCIAL) {
+        throw std::runtime_error(ruta + " tiene una version de formato no soportada: " + std::to_string(version));
+    }
+
+    ResultadoParcial parcial;
+    size_t numRangos = 0, numCubetas = 0;
+
+    leerClave(archivo, "modelo");
+    archivo >> parcial.mediaEntreLlegadas >> parcial.mediaServicio >> parcial.numEsperasRequerido;
+    leerClave(archivo, "perfil");
+    std::getline(archivo >> std::ws, parcial.perfil);
+    leerClave(archivo, "flujos");
+    archivo >> parcial.longitudFlujo;
+    leerClave(archivo, "replicas");
+    archivo >> parcial.numReplicas;
+    leerClave(archivo, "semillas");
+    archivo >> numRangos;
+    parcial.rangosSemillas.resize(numRangos);
+    long long semillasEnRangos = 0;
+    for (auto &rango: parcial.rangosSemillas) {
+        archivo >> rango.first >> rango.second;
+        semillasEnRangos += rango.second - rango.first + 1;
+    }
+
+    parcial.demoraPromedio = leerSuma(archivo, "demora");
+    parcial.colaPromedio = leerSuma(archivo, "cola");
+    parcial.usoServidor = leerSuma(archivo, "uso");
+
+    leerClave(archivo, "histograma");
+    archivo >> parcial.anchoCubeta >> numCubetas;
+    parcial.cubetasDemora.resize(numCubetas);
+    for (long long &conteo: parcial.cubetasDemora) {
+        archivo >> conteo;
+    }
+
+    if (!archivo) {
+        throw std::runtime_error(ruta + " esta incompleto o corrupto");
+    }
+    if (semillasEnRangos != parcial.numReplicas) {
+        throw std::runtime_error(ruta + " declara " + std::to_string(parcial.numReplicas) +
+                                 " replicas pero sus rangos de semillas suman " + std::to_string(semillasEnRangos));
+    }
+    return parcial;
+}
+
+/**
+ * @brief Devuelve el cuantil 0.975 de la distribución t de Student.
+ *
+ * Usa una tabla para pocos grados de libertad y la expansión de Cornish-Fisher alrededor del cuantil normal
+ * para el resto.
+ *
+ * @param gradosLibertad Los grados de libertad, al menos 1.
+ * @return El cuantil para un intervalo de confianza bilateral del 95%.
+ */
+double CuantilT975(long long gradosLibertad) {
+    static const double tabla[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (gradosLibertad < 1) {
+        return NAN;
+    }
+    if (gradosLibertad <= 30) {
+        return tabla[gradosLibertad - 1];
+    }
+
+    const double z = 1.959963984540054;
+    double v = static_cast<double>(gradosLibertad);
+    return z + (z * z * z + z) / (4.0 * v) + (5.0 * std::pow(z, 5) + 16.0 * z * z * z + 3.0 * z) / (96.0 * v * v);
+}
@@ -0,0 +1,65 @@
+#ifndef METALLER2_RESULTADOPARCIAL_H
+#define METALLER2_RESULTADOPARCIAL_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr int VERSION_RESULTADO_PARCIAL = 3;
+constexpr int NUM_CUBETAS_DEMORA = 128;
+constexpr char SIN_PERFIL[] = "ninguno";
+
+/**
+ * @brief Estadísticos suficientes de una muestra: tamaño, media y suma de cuadrados de las desviaciones.
+ *
+ * Dos acumuladores se combinan con la fórmula de Chan et al., que da la misma media y varianza que si todas las
+ * observaciones se hubieran agregado a un único acumulador.
+ */
+struct SumaSuficiente {
+    long long n = 0;
+    double media = 0.0;
+    double m2 = 0.0;
+
+    void agregar(double x);
+    void fusionar(const SumaSuficiente &otra);
+    double varianza() const;
+};
+
+/**
+ * @brief Resultado parcial de un conjunto de réplicas independientes del modelo M/M/1.
+ *
+ * Cada réplica aporta una observación de la demora promedio, el número promedio en cola y el uso del servidor, y
+ * todas las demoras individuales de sus clientes al histograma. Los resultados parciales de varios procesos se
+ * fusionan sin pérdida siempre que describan el mismo modelo y rangos de semillas disjuntos.
+ */
+struct ResultadoParcial {
+    float mediaEntreLlegadas = 0.0f;
+    float mediaServicio = 0.0f;
+    int numEsperasRequerido = 0;
+
+    /**
+     * Descripción del perfil de llegadas (ver PerfilLlegadas::descripcion), o SIN_PERFIL con llegadas estacionarias.
+     * Con perfil, la media entre llegadas y el número de demoras no se usan y se guardan en cero.
+     */
+    std::string perfil = SIN_PERFIL;
+
+    /** Números aleatorios disponibles por réplica; parciales con flujos de distinta longitud no son comparables. */
+    long long longitudFlujo = 0;
+
+    long long numReplicas = 0;
+    std::vector<std::pair<int, int>> rangosSemillas;
+
+    SumaSuficiente demoraPromedio, colaPromedio, usoServidor;
+
+    /** Cubetas de ancho anchoCubeta; la última cubeta acumula las demoras fuera de rango. */
+    double anchoCubeta = 0.0;
+    std::vector<long long> cubetasDemora;
+
+    void fusionar(const ResultadoParcial &otro);
+};
+
+void EscribirResultadoParcial(const std::string &ruta, const ResultadoParcial &parcial);
+ResultadoParcial LeerResultadoParcial(const std::string &ruta);
+double CuantilT975(long long gradosLibertad);
+
+#endif //METALLER2_RESULTADOPARCIAL_H
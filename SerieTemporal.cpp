@@ -0,0 +1,139 @@
+/**
+ * @archivo SerieTemporal.cpp
+ * @brief Muestreo periódico del estado de la cola con reducción mín/máx en memoria fija.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+#include "SerieTemporal.h"
+
+/**
+ * @brief El constructor de SerieTemporal.
+ *
+ * @param intervalo El tiempo simulado entre muestras consecutivas.
+ * @param capacidad El número máximo de puntos guardados; debe ser par.
+ */
+SerieTemporal::SerieTemporal(double intervalo, size_t capacidad)
+        : intervalo(intervalo), proximaMuestra(0.0), numMuestras(0), muestrasPorPunto(1), numPuntos(0),
+          puntos(capacidad) {
+    if (intervalo <= 0.0) {
+        throw std::invalid_argument("El intervalo de muestreo debe ser positivo");
+    }
+    if (capacidad < 2 || capacidad % 2 != 0) {
+        throw std::invalid_argument("La capacidad de la serie temporal debe ser par");
+    }
+}
+
+/**
+ * @brief Descarta los puntos registrados para comenzar una nueva réplica.
+ */
+void SerieTemporal::reiniciar() {
+    proximaMuestra = 0.0;
+    numMuestras = 0;
+    muestrasPorPunto = 1;
+    numPuntos = 0;
+}
+
+/**
+ * @brief Registra todas las muestras pendientes hasta el instante dado.
+ *
+ * Debe invocarse antes de procesar el evento, de modo que las muestras tomen el estado vigente desde el evento
+ * anterior. Las muestras idénticas de un mismo intervalo entre eventos se agregan en bloque, así que el costo no
+ * depende de cuántas muestras caigan entre dos eventos.
+ *
+ * @param tiempoSimulacion El instante del evento que está por procesarse.
+ * @param numEnCola El número en cola desde el evento anterior.
+ * @param estadoServidor El estado del servidor desde el evento anterior.
+ * @param demoraPromedio La demora promedio en cola acumulada hasta el evento anterior.
+ */
+void SerieTemporal::muestrear(float tiempoSimulacion, int numEnCola, int estadoServidor, float demoraPromedio) {
+    auto ultimaMuestra = static_cast<long long>(std::floor(static_cast<double>(tiempoSimulacion) / intervalo));
+    long long repeticiones = ultimaMuestra - numMuestras + 1;
+
+    while (repeticiones > 0) {
+        if (numPuntos == 0 || puntos[numPuntos - 1].muestras == muestrasPorPunto) {
+            if (numPuntos == puntos.size()) {
+                compactar();
+            }
+            Punto &nuevo = puntos[numPuntos++];
+            nuevo.tiempoInicio = static_cast<double>(numMuestras) * intervalo;
+            nuevo.muestras = 0;
+            nuevo.colaMin = numEnCola;
+            nuevo.colaMax = numEnCola;
+            nuevo.colaSuma = 0.0;
+            nuevo.servidorSuma = 0.0;
+        }
+
+        Punto &actual = puntos[numPuntos - 1];
+        long long bloque = std::min(repeticiones, muestrasPorPunto - actual.muestras);
+
+        actual.muestras += bloque;
+        actual.colaMin = std::min(actual.colaMin, numEnCola);
+        actual.colaMax = std::max(actual.colaMax, numEnCola);
+        actual.colaSuma += static_cast<double>(numEnCola) * static_cast<double>(bloque);
+        actual.servidorSuma += static_cast<double>(estadoServidor) * static_cast<double>(bloque);
+        actual.demoraPromedio = demoraPromedio;
+
+        numMuestras += bloque;
+        actual.tiempoFin = static_cast<double>(numMuestras - 1) * intervalo;
+        repeticiones -= bloque;
+    }
+
+    proximaMuestra = static_cast<double>(numMuestras) * intervalo;
+}
+
+/**
+ * @brief Fusiona cada par de puntos vecinos, dejando la mitad del arreglo libre.
+ */
+void SerieTemporal::compactar() {
+    for (size_t i = 0; i < numPuntos / 2; ++i) {
+        const Punto &a = puntos[2 * i];
+        const Punto &b = puntos[2 * i + 1];
+
+        Punto fusionado{};
+        fusionado.tiempoInicio = a.tiempoInicio;
+        fusionado.tiempoFin = b.tiempoFin;
+        fusionado.muestras = a.muestras + b.muestras;
+        fusionado.colaMin = std::min(a.colaMin, b.colaMin);
+        fusionado.colaMax = std::max(a.colaMax, b.colaMax);
+        fusionado.colaSuma = a.colaSuma + b.colaSuma;
+        fusionado.servidorSuma = a.servidorSuma + b.servidorSuma;
+        fusionado.demoraPromedio = b.demoraPromedio;
+
+        puntos[i] = fusionado;
+    }
+    numPuntos /= 2;
+    muestrasPorPunto *= 2;
+}
+
+/**
+ * @brief Escribe la serie en un archivo de texto, un punto por línea.
+ *
+ * Cada réplica comienza con una línea de comentario con su semilla, el intervalo de muestreo y las muestras por
+ * punto, seguida de las columnas: tiempo inicial, tiempo final, muestras, cola mínima, cola máxima, cola promedio,
+ * uso del servidor y demora promedio acumulada.
+ *
+ * @param ruta La ruta del archivo.
+ * @param semilla La semilla de la réplica.
+ * @param anexar Si es verdadero, la serie se agrega al final del archivo en lugar de reemplazarlo.
+ */
+void SerieTemporal::escribir(const std::string &ruta, int semilla, bool anexar) const {
+    std::ofstream archivo(ruta, anexar ? std::ios::app : std::ios::trunc);
+    if (!archivo.is_open()) {
+        throw std::runtime_error("No se pudo crear la serie temporal " + ruta);
+    }
+
+    archivo << "# semilla " << semilla << " intervalo " << intervalo << " muestras por punto " << muestrasPorPunto << "\n";
+    archivo << "# desde , hasta , muestras , cola min , cola max , cola promedio , uso del servidor , demora promedio\n";
+    for (size_t i = 0; i < numPuntos; ++i) {
+        const Punto &punto = puntos[i];
+        auto muestras = static_cast<double>(punto.muestras);
+        archivo << punto.tiempoInicio << " , " << punto.tiempoFin << " , " << punto.muestras << " , "
+                << punto.colaMin << " , " << punto.colaMax << " , "
+                << punto.colaSuma / muestras << " , " << punto.servidorSuma / muestras << " , "
+                << punto.demoraPromedio << "\n";
+    }
+}
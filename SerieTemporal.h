@@ -0,0 +1,50 @@
+#ifndef METALLER2_SERIETEMPORAL_H
+#define METALLER2_SERIETEMPORAL_H
+
+#include <string>
+#include <vector>
+
+constexpr int CAPACIDAD_SERIE = 4096;
+
+/**
+ * @clase SerieTemporal
+ * @brief Registro del estado de la cola muestreado cada intervalo fijo de tiempo simulado, en memoria acotada.
+ *
+ * Las muestras se agrupan en un arreglo de capacidad fija de puntos. Cuando el arreglo se llena, cada par de
+ * puntos vecinos se fusiona en uno que conserva el mínimo y el máximo de la cola, y cada punto pasa a cubrir el
+ * doble de muestras. Así una corrida de cualquier longitud termina con a lo sumo CAPACIDAD_SERIE puntos, y con al
+ * menos CAPACIDAD_SERIE / 2 una vez que el arreglo se ha compactado, sin perder los picos de congestión.
+ */
+class SerieTemporal {
+private:
+    struct Punto {
+        double tiempoInicio, tiempoFin;
+        long long muestras;
+        int colaMin, colaMax;
+        double colaSuma, servidorSuma;
+        float demoraPromedio;
+    };
+
+    double intervalo, proximaMuestra;
+    long long numMuestras, muestrasPorPunto;
+    size_t numPuntos;
+    std::vector<Punto> puntos;
+
+    void compactar();
+
+public:
+    SerieTemporal(double intervalo, size_t capacidad = CAPACIDAD_SERIE);
+
+    void reiniciar();
+    void muestrear(float tiempoSimulacion, int numEnCola, int estadoServidor, float demoraPromedio);
+    void escribir(const std::string &ruta, int semilla, bool anexar) const;
+
+    /**
+     * @brief Indica si hay muestras pendientes hasta el instante dado; es la única comprobación por evento.
+     */
+    bool pendiente(float tiempoSimulacion) const {
+        return tiempoSimulacion >= proximaMuestra;
+    }
+};
+
+#endif //METALLER2_SERIETEMPORAL_H
@@ -3,14 +3,21 @@
 #include <vector>
 #include <cmath>
 #include <iomanip>
+#include <algorithm>
+#include <string>
+#include <stdexcept>
+#include <memory>
 
 #include "lcgrand.h"
 #include "erlangf.h"
 #include "CustomerData.h"
+#include "EstacionesMM1.h"
+#include "ResultadoParcial.h"
+#include "PerfilLlegadas.h"
+#include "SerieTemporal.h"
 
 constexpr int LIMITE_COLA = 2000;
-constexpr int OCUPADO = 1;
-constexpr int LIBRE = 0;
+constexpr int FLUJO_REPLICA = 1;
 int VAL_ALE_SEMILLA = 0;
 
 constexpr char PARAMS_ABS_PATH[] = R"(..\params.txt)";
@@ -39,19 +46,34 @@ constexpr char REPORT_ABS_PATH[] = R"(..\results.txt)";
  */
 class SimulacionMM1 {
 private:
-    int sigTipoEvento, numClientesEsperando,
-            numEsperasRequerido, numEventos,
-            numEnCola, estadoServidor, numCliente;
+    /**
+     * @brief Estadísticas de una ventana de tiempo cuando las llegadas siguen un perfil no estacionario.
+     *
+     * Las llegadas y demoras se asignan a la ventana en que llegó el cliente; las áreas se reparten entre las
+     * ventanas que abarca cada intervalo entre eventos.
+     */
+    struct EstadisticasVentana {
+        long long llegadas = 0, demoras = 0;
+        float totalDeEsperas = 0.0f, areaNumEnCola = 0.0f, areaEstadoServidor = 0.0f;
+    };
 
-    float areaNumEnCola, areaEstadoServidor,
-            mediaEntreLlegadas, mediaServicio,
-            tiempoSimulacion, tiempoUltimoEvento, totalDeEsperas,
-            tiempoUltimaLlegada;
+    int sigTipoEvento, numEsperasRequerido, numEventos, numCliente, semillaReplica;
+    bool conFlujoReplica;
 
-    std::vector<float> tiempoLlegada;
+    float mediaEntreLlegadas, mediaServicio,
+            tiempoSimulacion, tiempoUltimaLlegada, anchoCubeta;
+
+    /** Estado y acumuladores del servidor, con la misma lógica que usa cada estación de SimulacionRedJackson. */
+    EstacionesMM1 estacion;
     std::vector<float> tiempoProximoEvento;
+    std::vector<long long> cubetasDemora;
     std::vector<CustomerData> datosClientes;
 
+    PerfilLlegadas *perfil = nullptr;
+    std::vector<EstadisticasVentana> ventanas;
+
+    SerieTemporal *serie = nullptr;
+
     std::ifstream parametros;
     std::ofstream resultados;
 
@@ -63,19 +85,22 @@ private:
     void inicializar() {
         tiempoSimulacion = 0.0;
 
-        estadoServidor = LIBRE;
-        numEnCola = 0;
-        tiempoUltimoEvento = 0.0;
-
-        numClientesEsperando = 0;
-        totalDeEsperas = 0.0;
-        areaNumEnCola = 0.0;
-        areaEstadoServidor = 0.0;
+        estacion.inicializar();
         tiempoUltimaLlegada = 0.0;
         numCliente = 0;
+        std::fill(cubetasDemora.begin(), cubetasDemora.end(), 0);
+        ventanas.clear();
+        if (perfil != nullptr) {
+            perfil->reiniciar();
+        }
+        if (serie != nullptr) {
+            serie->reiniciar();
+        }
 
-        tiempoProximoEvento[1] = tiempoSimulacion + exponencial(mediaEntreLlegadas);
+        tiempoProximoEvento[1] = proximaLlegada();
         tiempoProximoEvento[2] = 1.0e+30;
+        tiempoProximoEvento[3] = perfil != nullptr ? perfil->horizonte() : 1.0e+30;
+        sigTipoEvento = 0;
     }
 
     /**
@@ -108,9 +133,12 @@ private:
      * Este método programa el próximo evento de llegada y verifica si el servidor está ocupado. Si el servidor está ocupado, aumenta la cantidad de clientes en la cola. Si el servidor está inactivo, programa el próximo evento de salida.
      */
     void llegada() {
-        float demora, tiempoEntreLlegadas;
+        float tiempoEntreLlegadas;
 
-        tiempoProximoEvento[1] = tiempoSimulacion + exponencial(mediaEntreLlegadas);
+        tiempoProximoEvento[1] = proximaLlegada();
+        if (perfil != nullptr) {
+            ventana(tiempoSimulacion).llegadas++;
+        }
 
         tiempoEntreLlegadas = tiempoSimulacion - tiempoUltimaLlegada;
         tiempoUltimaLlegada = tiempoSimulacion;
@@ -119,23 +147,14 @@ private:
         cliente.timeDifference = tiempoEntreLlegadas;
         datosClientes.push_back(cliente);
 
-        if (estadoServidor == OCUPADO) {
-            ++numEnCola;
-
-            if (numEnCola > LIMITE_COLA) {
-                resultados << "Error: Sobrecarga en el vector tiempoLlegada: \n";
-                resultados << "Tiempo: " << tiempoSimulacion << " \n";
-                exit(2);
-            }
-            tiempoLlegada[numEnCola] = tiempoSimulacion;
-        } else {
-            demora = 0.0;
-            totalDeEsperas += demora;
-
-            ++numClientesEsperando;
-            estadoServidor = OCUPADO;
+        if (estacion.llegada(0, tiempoSimulacion)) {
+            registrarDemora(static_cast<float>(estacion.ultimaDemora[0]), tiempoSimulacion);
 
             tiempoProximoEvento[2] = tiempoSimulacion + exponencial(mediaServicio);
+        } else if (estacion.numEnCola[0] > LIMITE_COLA) {
+            resultados << "Error: Sobrecarga en el vector tiempoLlegada: \n";
+            resultados << "Tiempo: " << tiempoSimulacion << " \n";
+            exit(2);
         }
     }
 
@@ -145,49 +164,71 @@ private:
      * Este método comprueba si la cola está vacía. Si la cola está vacía, establece el estado del servidor en inactivo. Si la cola no está vacía, disminuye la cantidad de clientes en la cola, calcula el retraso y programa el próximo evento de salida.
      */
     void salida() {
-        float demora;
-
-        if (numEnCola == 0) {
-            estadoServidor = LIBRE;
+        if (!estacion.salida(0, tiempoSimulacion)) {
             tiempoProximoEvento[2] = 1.0e+30;
         } else {
-            --numEnCola;
-
-            demora = tiempoSimulacion - tiempoLlegada[1];
-            totalDeEsperas += demora;
+            auto demora = static_cast<float>(estacion.ultimaDemora[0]);
+            registrarDemora(demora, tiempoSimulacion - demora);
 
             datosClientes[numCliente].attentionTime = demora;
             datosClientes[numCliente].id = numCliente + 1;
             numCliente++;
 
-            ++numClientesEsperando;
             tiempoProximoEvento[2] = tiempoSimulacion + exponencial(mediaServicio);
-            for (int i = 1; i <= numEnCola; ++i) {
-                tiempoLlegada[i] = tiempoLlegada[i + 1];
-            }
         }
     }
 
+    /**
+     * @brief Escribe el encabezado del reporte con los parámetros del modelo.
+     *
+     * Con perfil de llegadas, la media entre llegadas y el número de clientes del archivo de parámetros no se usan, por
+     * lo que se reemplazan por el horizonte del perfil y las llegadas esperadas hasta él.
+     */
+    void encabezado() {
+        resultados << "=============================================\n";
+        resultados << "|| Modelo de Colas Servidor Unico (Modelo M/M/1)\n";
+        resultados << "=============================================\n";
+        if (perfil == nullptr) {
+            resultados << "|| Media entre llegadas:   " << std::setw(10) << mediaEntreLlegadas << " minutos.\n";
+        } else {
+            resultados << "|| Horizonte del perfil:   " << std::setw(10) << perfil->horizonte() << " minutos.\n";
+        }
+        resultados << "|| Media del servicio:     " << std::setw(10) << mediaServicio << " minutos.\n";
+        if (perfil == nullptr) {
+            resultados << "|| Numero de clientes:     " << std::setw(10) << numEsperasRequerido << " clientes.\n";
+        } else {
+            resultados << "|| Llegadas esperadas:     " << std::setw(10) << perfil->llegadasEsperadas(0.0f, perfil->horizonte()) << " clientes.\n";
+        }
+        resultados << "|| Valor de la semilla:    " << std::setw(10) << semillaReplica << "\n";
+        resultados << "=============================================\n";
+    }
+
     /**
      * @brief Genera informes.
      *
      * Este método calcula e imprime el retraso promedio en la cola, el número promedio de clientes en la cola, la tasa de utilización del servidor y la hora de finalización de la simulación.
+     * Las fórmulas de Erlang solo se reportan con llegadas estacionarias, pues suponen una tasa de llegadas fija.
      */
     void reporte() {
         resultados << "\n\n";
         resultados << "=============================================\n";
         resultados << "|| Resultado de la Simulacion\n";
         resultados << "=============================================\n";
-        resultados << "|| Demora promedio en la cola:             " << std::setw(10) << (totalDeEsperas / static_cast<float>(numClientesEsperando)) << " minutos.\n";
-        resultados << "|| Numero de Clientes promedio en la cola: " << std::setw(10) << (areaNumEnCola / tiempoSimulacion) << " clientes.\n";
-        resultados << "|| Tasa de uso del servidor:                " << std::setw(10) << (areaEstadoServidor / tiempoSimulacion) << " .\n";
+        resultados << "|| Demora promedio en la cola:             " << std::setw(10) << demoraPromedio() << " minutos.\n";
+        resultados << "|| Numero de Clientes promedio en la cola: " << std::setw(10) << (estacion.areaNumEnCola[0] / tiempoSimulacion) << " clientes.\n";
+        resultados << "|| Tasa de uso del servidor:                " << std::setw(10) << (estacion.areaEstadoServidor[0] / tiempoSimulacion) << " .\n";
         resultados << "|| Simulacion terminada a los:             " << std::setw(10) << tiempoSimulacion << " minutos.\n";
         resultados << "=============================================\n";
-        resultados << "|| Valores de las formulas de Erlang: \n";
-        resultados << "=============================================\n";
-        resultados << "|| Erlang B:                               " << std::setw(10) << ErlangB(1, mediaEntreLlegadas, mediaServicio) << " \n";
-        resultados << "|| Erlang C:                               " << std::setw(10) << ErlangC(1, mediaEntreLlegadas, mediaServicio) << " \n";
-        resultados << "=============================================\n";
+
+        if (perfil == nullptr) {
+            resultados << "|| Valores de las formulas de Erlang: \n";
+            resultados << "=============================================\n";
+            resultados << "|| Erlang B:                               " << std::setw(10) << ErlangB(1, mediaEntreLlegadas, mediaServicio) << " \n";
+            resultados << "|| Erlang C:                               " << std::setw(10) << ErlangC(1, mediaEntreLlegadas, mediaServicio) << " \n";
+            resultados << "=============================================\n";
+        } else {
+            reporteVentanas();
+        }
 
         resultados << "=============================================\n";
         resultados << "|| Data de los clientes\n";
@@ -202,17 +243,140 @@ private:
         resultados << "=============================================\n";
     }
 
+    /**
+     * @brief Genera el informe por ventana de tiempo de una simulación con perfil de llegadas.
+     *
+     * Para cada ventana imprime las llegadas observadas y esperadas según el perfil, la demora promedio de los clientes
+     * que llegaron en ella, el número promedio en cola y la tasa de uso del servidor.
+     */
+    void reporteVentanas() {
+        resultados << "=============================================\n";
+        resultados << "|| Perfil de llegadas no estacionario\n";
+        resultados << "=============================================\n";
+        resultados << "|| Tipo de perfil:                         " << std::setw(10) << (perfil->tipoPerfil() == PERFIL_LINEAL ? "lineal" : "constante") << " \n";
+        resultados << "|| Puntos del perfil:                      " << std::setw(10) << perfil->numPuntos() << " \n";
+        resultados << "|| Ancho de ventana:                       " << std::setw(10) << perfil->ventana() << " minutos.\n";
+        resultados << "|| Candidatos aceptados:                   " << std::setw(10) << perfil->tasaAceptacion() << " \n";
+        resultados << "=============================================\n";
+        resultados << "Desde , Hasta , Llegadas , Llegadas esperadas , Demora promedio , Clientes promedio en cola , Tasa de uso del servidor\n";
+        for (size_t i = 0; i < ventanas.size(); ++i) {
+            const EstadisticasVentana &actual = ventanas[i];
+            float desde = static_cast<float>(i) * perfil->ventana();
+            float hasta = std::min(desde + perfil->ventana(), tiempoSimulacion);
+            float duracion = hasta - desde;
+
+            resultados << desde << " , " << hasta << " , "
+                       << actual.llegadas << " , " << perfil->llegadasEsperadas(desde, hasta) << " , "
+                       << (actual.demoras > 0 ? actual.totalDeEsperas / static_cast<float>(actual.demoras) : 0.0f) << " , "
+                       << (duracion > 0.0f ? actual.areaNumEnCola / duracion : 0.0f) << " , "
+                       << (duracion > 0.0f ? actual.areaEstadoServidor / duracion : 0.0f) << "\n";
+        }
+        resultados << "=============================================\n";
+    }
+
     /**
      * @brief Actualiza acumuladores estadísticos de tiempo promedio.
      *
      * Este método calcula el tiempo desde el último evento y actualiza el área bajo la función de número en cola y la función de indicador de servidor ocupado.
+     * Si hay una serie temporal activa, primero registra las muestras del estado vigente desde el último evento.
      */
     void actEstadisticasTiempoProm() {
-        float timeSinceLastEvent = tiempoSimulacion - tiempoUltimoEvento;
-        tiempoUltimoEvento = tiempoSimulacion;
+        if (serie != nullptr && serie->pendiente(tiempoSimulacion)) {
+            serie->muestrear(tiempoSimulacion, estacion.numEnCola[0], estacion.estadoServidor[0], demoraPromedio());
+        }
+
+        if (perfil != nullptr) {
+            acumularVentanas(static_cast<float>(estacion.tiempoUltimoEvento[0]), tiempoSimulacion);
+        }
+        estacion.actEstadisticasTiempoProm(0, tiempoSimulacion);
+    }
+
+    /**
+     * @brief Indica si la simulación debe continuar.
+     *
+     * Sin perfil, la simulación continúa hasta completar numEsperasRequerido demoras. Con perfil, continúa hasta el
+     * evento de fin de simulación (tipo 3), programado en el horizonte del perfil.
+     */
+    bool continuar() const {
+        if (perfil != nullptr) {
+            return sigTipoEvento != 3;
+        }
+        return estacion.numClientesEsperando[0] < numEsperasRequerido;
+    }
+
+    /**
+     * @brief Devuelve la demora promedio en cola de los clientes que ya pasaron a servicio, o cero si no hay ninguno.
+     */
+    float demoraPromedio() const {
+        if (estacion.numClientesEsperando[0] == 0) {
+            return 0.0f;
+        }
+        return static_cast<float>(estacion.totalDeEsperas[0] / static_cast<double>(estacion.numClientesEsperando[0]));
+    }
+
+    /**
+     * @brief Reparte las áreas bajo el número en cola y el estado del servidor entre las ventanas de tiempo.
+     *
+     * @param desde El instante del último evento.
+     * @param hasta El instante actual de la simulación.
+     */
+    void acumularVentanas(float desde, float hasta) {
+        auto indice = static_cast<size_t>(desde / perfil->ventana());
+        while (desde < hasta) {
+            if (indice >= ventanas.size()) {
+                ventanas.resize(indice + 1);
+            }
+            float fin = std::min(hasta, static_cast<float>(indice + 1) * perfil->ventana());
+            float duracion = std::max(fin - desde, 0.0f);
+
+            ventanas[indice].areaNumEnCola += static_cast<float>(estacion.numEnCola[0]) * duracion;
+            ventanas[indice].areaEstadoServidor += static_cast<float>(estacion.estadoServidor[0]) * duracion;
+            desde = std::max(desde, fin);
+            ++indice;
+        }
+    }
+
+    /**
+     * @brief Devuelve las estadísticas de la ventana que contiene el instante dado, creándola si no existe.
+     */
+    EstadisticasVentana &ventana(float tiempo) {
+        auto indice = static_cast<size_t>(tiempo / perfil->ventana());
+        if (indice >= ventanas.size()) {
+            ventanas.resize(indice + 1);
+        }
+        return ventanas[indice];
+    }
+
+    /**
+     * @brief Registra la demora de un cliente en el histograma de demoras y, con perfil de llegadas, en su ventana.
+     *
+     * Las demoras mayores al rango del histograma se acumulan en la última cubeta.
+     *
+     * @param demora La demora en cola del cliente.
+     * @param tiempoLlegadaCliente El instante en que llegó el cliente.
+     */
+    void registrarDemora(float demora, float tiempoLlegadaCliente) {
+        auto cubeta = static_cast<size_t>(demora / anchoCubeta);
+        cubetasDemora[std::min(cubeta, cubetasDemora.size() - 1)]++;
+
+        if (perfil != nullptr) {
+            EstadisticasVentana &actual = ventana(tiempoLlegadaCliente);
+            actual.demoras++;
+            actual.totalDeEsperas += demora;
+        }
+    }
 
-        areaNumEnCola += static_cast<float>(numEnCola) * timeSinceLastEvent;
-        areaEstadoServidor += static_cast<float>(estadoServidor) * timeSinceLastEvent;
+    /**
+     * @brief Devuelve el instante de la siguiente llegada.
+     *
+     * Sin perfil, el tiempo entre llegadas es exponencial con media mediaEntreLlegadas. Con perfil, la llegada se
+     * genera por adelgazamiento según la tasa variable del perfil.
+     */
+    float proximaLlegada() {
+        if (perfil != nullptr) {
+            return perfil->siguienteLlegada(tiempoSimulacion, VAL_ALE_SEMILLA);
+        }
+        return tiempoSimulacion + exponencial(mediaEntreLlegadas);
     }
 
     /**
@@ -244,35 +408,40 @@ public:
     /**
      * @brief El constructor de SimulaciónMM1.
      *
-     * Este constructor inicializa los vectores tiempoLlegada y tiempoProximoEvento.
+     * Este constructor inicializa la estación, y los vectores tiempoProximoEvento y cubetasDemora.
+     *
+     * @param semilla Si es mayor que cero, reemplaza la semilla leída del archivo de parámetros por el flujo de réplica
+     * con ese número (ver LCGrandFlujo), que admite hasta MAX_FLUJOS réplicas independientes.
+     * @param anexarReporte Si es verdadero, el reporte se agrega al final del archivo de resultados en lugar de reemplazarlo.
      */
-    SimulacionMM1() : tiempoLlegada(LIMITE_COLA + 1), tiempoProximoEvento(3) {
+    explicit SimulacionMM1(int semilla = 0, bool anexarReporte = false)
+            : estacion(1), tiempoProximoEvento(4), cubetasDemora(NUM_CUBETAS_DEMORA) {
         parametros.open(PARAMS_ABS_PATH);
-        resultados.open(REPORT_ABS_PATH);
+        resultados.open(REPORT_ABS_PATH, anexarReporte ? std::ios::app : std::ios::trunc);
 
         numEventos = 2;
 
         parametros >> mediaEntreLlegadas >> mediaServicio >> numEsperasRequerido >> VAL_ALE_SEMILLA;
-
-        resultados << "=============================================\n";
-        resultados << "|| Modelo de Colas Servidor Unico (Modelo M/M/1)\n";
-        resultados << "=============================================\n";
-        resultados << "|| Media entre llegadas:   " << std::setw(10) << mediaEntreLlegadas << " minutos.\n";
-        resultados << "|| Media del servicio:     " << std::setw(10) << mediaServicio << " minutos.\n";
-        resultados << "|| Numero de clientes:     " << std::setw(10) << numEsperasRequerido << " clientes.\n";
-        resultados << "|| Valor de la semilla:    " << std::setw(10) << VAL_ALE_SEMILLA << "\n";
-        resultados << "=============================================\n";
+        semillaReplica = VAL_ALE_SEMILLA;
+        conFlujoReplica = semilla > 0;
+        if (conFlujoReplica) {
+            VAL_ALE_SEMILLA = FLUJO_REPLICA;
+            LCGrandFlujo(VAL_ALE_SEMILLA, semilla);
+            semillaReplica = semilla;
+        }
+        anchoCubeta = mediaServicio / 4.0f;
     }
 
     /**
      * @brief Ejecuta la simulación.
      *
-     * Este método inicializa la simulación y luego la ejecuta hasta que se haya retrasado el número especificado de clientes. Determina el próximo evento, actualiza los acumuladores estadísticos de tiempo promedio y maneja la llegada o salida de clientes según el tipo de evento. Finalmente, genera informes.
+     * Este método escribe el encabezado del reporte, inicializa la simulación y luego la ejecuta hasta que se haya retrasado el número especificado de clientes o, con perfil de llegadas, hasta el evento de fin de simulación en el horizonte del perfil. Determina el próximo evento, actualiza los acumuladores estadísticos de tiempo promedio y maneja la llegada o salida de clientes según el tipo de evento. Finalmente, genera informes.
      */
     void ejecutar() {
+        encabezado();
         inicializar();
 
-        while (numClientesEsperando < numEsperasRequerido) {
+        while (continuar()) {
             temporizador();
             actEstadisticasTiempoProm();
 
@@ -283,19 +452,166 @@ public:
                 case 2:
                     salida();
                     break;
+                case 3:
+                    break;
             }
         }
 
+        if (conFlujoReplica && LCGrandUsados(VAL_ALE_SEMILLA) > LONGITUD_FLUJO) {
+            throw std::runtime_error("La replica " + std::to_string(semillaReplica) +
+                                     " agoto su flujo de numeros aleatorios y se traslaparia con la siguiente");
+        }
+
         reporte();
         limpieza();
     }
 
+    /**
+     * @brief Reemplaza la media entre llegadas fija por un perfil de tasa de llegadas variable en el tiempo.
+     *
+     * Debe invocarse antes de ejecutar(). Con perfil, la simulación termina en el horizonte del perfil en lugar de al
+     * completar numEsperasRequerido demoras, y el reporte incluye estadísticas por ventana de tiempo.
+     *
+     * @param perfilLlegadas El perfil de llegadas, o nullptr para llegadas estacionarias.
+     */
+    void usarPerfil(PerfilLlegadas *perfilLlegadas) {
+        perfil = perfilLlegadas;
+        numEventos = perfil != nullptr ? 3 : 2;
+    }
+
+    /**
+     * @brief Activa el registro periódico del estado de la cola en una serie temporal.
+     *
+     * Debe invocarse antes de ejecutar(). La serie se reinicia al inicializar la simulación.
+     *
+     * @param serieTemporal La serie temporal, o nullptr para no registrar.
+     */
+    void usarSerie(SerieTemporal *serieTemporal) {
+        serie = serieTemporal;
+    }
+
+    /**
+     * @brief Devuelve la semilla con la que se ejecutó la réplica.
+     */
+    int semilla() const {
+        return semillaReplica;
+    }
+
+    /**
+     * @brief Agrega los resultados de esta réplica a un resultado parcial.
+     *
+     * Debe invocarse después de ejecutar(). La réplica aporta su demora promedio, número promedio en cola, uso del
+     * servidor y el histograma de demoras de sus clientes. Con perfil de llegadas, el resultado parcial guarda la
+     * descripción del perfil en lugar de la media entre llegadas y el número de demoras, que no se usaron.
+     *
+     * @param parcial El resultado parcial que acumula las réplicas.
+     */
+    void acumularEn(ResultadoParcial &parcial) const {
+        if (parcial.numReplicas == 0) {
+            parcial.mediaEntreLlegadas = perfil == nullptr ? mediaEntreLlegadas : 0.0f;
+            parcial.mediaServicio = mediaServicio;
+            parcial.numEsperasRequerido = perfil == nullptr ? numEsperasRequerido : 0;
+            parcial.perfil = perfil == nullptr ? SIN_PERFIL : perfil->descripcion();
+            parcial.longitudFlujo = LONGITUD_FLUJO;
+            parcial.anchoCubeta = anchoCubeta;
+            parcial.cubetasDemora.assign(cubetasDemora.size(), 0);
+        }
+
+        ++parcial.numReplicas;
+        if (!parcial.rangosSemillas.empty() && parcial.rangosSemillas.back().second + 1 == semillaReplica) {
+            parcial.rangosSemillas.back().second = semillaReplica;
+        } else {
+            parcial.rangosSemillas.emplace_back(semillaReplica, semillaReplica);
+        }
+
+        parcial.demoraPromedio.agregar(demoraPromedio());
+        parcial.colaPromedio.agregar(estacion.areaNumEnCola[0] / tiempoSimulacion);
+        parcial.usoServidor.agregar(estacion.areaEstadoServidor[0] / tiempoSimulacion);
+
+        for (size_t i = 0; i < cubetasDemora.size(); ++i) {
+            parcial.cubetasDemora[i] += cubetasDemora[i];
+        }
+    }
+
 };
 
-int main() {
+/**
+ * @brief Punto de entrada del simulador.
+ *
+ * Sin argumentos ejecuta una réplica con la semilla del archivo de parámetros. Con --semillas ejecuta una réplica
+ * por cada semilla del rango, cada una con su propio flujo del generador, y agrega sus reportes al archivo de
+ * resultados. Con --parcial, que requiere --semillas, escribe además un resultado parcial que METaller2Fusion puede
+ * combinar con los de otros procesos. Con --perfil las llegadas siguen
+ * la tasa variable del archivo de perfil en lugar de la media entre llegadas fija. Con --serie se registra el estado
+ * de la cola cada intervalo de tiempo simulado, y cada réplica agrega su serie al archivo indicado.
+ *
+ * Uso: METaller2 [--semillas <inicial> <final>] [--parcial <archivo>] [--perfil <archivo>] [--serie <archivo> <intervalo>]
+ */
+int main(int argc, char *argv[]) {
     try {
-        SimulacionMM1 simulacionMM1;
-        simulacionMM1.ejecutar();
+        int semillaInicial = 0, semillaFinal = 0;
+        bool conSemillas = false;
+        std::string rutaParcial, rutaPerfil, rutaSerie;
+        double intervaloSerie = 0.0;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string opcion = argv[i];
+            if (opcion == "--semillas" && i + 2 < argc) {
+                conSemillas = true;
+                semillaInicial = std::stoi(argv[++i]);
+                semillaFinal = std::stoi(argv[++i]);
+            } else if (opcion == "--parcial" && i + 1 < argc) {
+                rutaParcial = argv[++i];
+            } else if (opcion == "--perfil" && i + 1 < argc) {
+                rutaPerfil = argv[++i];
+            } else if (opcion == "--serie" && i + 2 < argc) {
+                rutaSerie = argv[++i];
+                intervaloSerie = std::stod(argv[++i]);
+            } else {
+                throw std::invalid_argument("Uso: METaller2 [--semillas <inicial> <final>] [--parcial <archivo>] [--perfil <archivo>] [--serie <archivo> <intervalo>]");
+            }
+        }
+        if (conSemillas && (semillaInicial < 1 || semillaFinal > MAX_FLUJOS || semillaInicial > semillaFinal)) {
+            throw std::invalid_argument("El rango de semillas debe estar entre 1 y " + std::to_string(MAX_FLUJOS));
+        }
+        if (!rutaParcial.empty() && !conSemillas) {
+            throw std::invalid_argument("--parcial requiere --semillas");
+        }
+
+        std::unique_ptr<PerfilLlegadas> perfil;
+        if (!rutaPerfil.empty()) {
+            perfil = std::make_unique<PerfilLlegadas>(rutaPerfil);
+        }
+        std::unique_ptr<SerieTemporal> serie;
+        if (!rutaSerie.empty()) {
+            serie = std::make_unique<SerieTemporal>(intervaloSerie);
+        }
+
+        ResultadoParcial parcial;
+        if (!conSemillas) {
+            SimulacionMM1 simulacionMM1;
+            simulacionMM1.usarPerfil(perfil.get());
+            simulacionMM1.usarSerie(serie.get());
+            simulacionMM1.ejecutar();
+            if (serie) {
+                serie->escribir(rutaSerie, simulacionMM1.semilla(), false);
+            }
+        } else {
+            for (int semilla = semillaInicial; semilla <= semillaFinal; ++semilla) {
+                SimulacionMM1 simulacionMM1(semilla, semilla != semillaInicial);
+                simulacionMM1.usarPerfil(perfil.get());
+                simulacionMM1.usarSerie(serie.get());
+                simulacionMM1.ejecutar();
+                simulacionMM1.acumularEn(parcial);
+                if (serie) {
+                    serie->escribir(rutaSerie, semilla, semilla != semillaInicial);
+                }
+            }
+        }
+
+        if (!rutaParcial.empty()) {
+            EscribirResultadoParcial(rutaParcial, parcial);
+        }
     } catch (const std::exception &e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 3;
@@ -0,0 +1,325 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <iomanip>
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+
+#include "lcgrand.h"
+#include "jacksonf.h"
+#include "EstacionesMM1.h"
+#include "PlanificadorEventos.h"
+
+constexpr int EVENTO_LLEGADA = 1;
+constexpr int EVENTO_SALIDA = 2;
+constexpr int MAX_SEMILLA = 100;
+
+constexpr char PARAMS_RED_ABS_PATH[] = R"(..\params_red.txt)";
+constexpr char REPORT_RED_ABS_PATH[] = R"(..\results_red.txt)";
+
+
+/**
+ * @archivo SimulacionRedJackson.cpp
+ * @brief Este archivo contiene la clase SimulacionRedJackson que simula una red abierta de estaciones M/M/1.
+ *
+ * Cada estación reutiliza la lógica de llegada, salida y acumuladores de SimulacionMM1. Los clientes que salen
+ * de una estación se enrutan a otra estación según una matriz de enrutamiento, o abandonan la red con la
+ * probabilidad restante de la fila. Los resultados de cada estación se comparan con los valores de forma
+ * producto de Jackson.
+ *
+ * @fecha octubre de 2026.
+*/
+
+/**
+ * @clase SimulacionRedJackson
+ * @brief La clase SimulacionRedJackson simula una red de colas en serie o con retroalimentación.
+ *
+ * El archivo de parámetros contiene, en orden: el número de estaciones, el número de demoras requerido (sumado
+ * sobre todas las estaciones) y la semilla; luego, por cada estación, la media entre llegadas externas (0 si la
+ * estación no recibe llegadas externas) y la media de servicio; por último la matriz de enrutamiento fila por fila.
+ */
+class SimulacionRedJackson {
+private:
+    int numEstaciones, numEsperasRequerido, numEsperasTotal, semilla;
+    double tiempoSimulacion;
+
+    std::vector<double> mediaEntreLlegadas, mediaServicio, tasasEfectivas;
+    std::vector<std::vector<double>> enrutamiento;
+
+    /** Filas no nulas de la matriz de enrutamiento con probabilidades acumuladas, para enrutar en O(log n). */
+    std::vector<std::vector<int>> destinos;
+    std::vector<std::vector<double>> probAcumulada;
+
+    EstacionesMM1 estaciones;
+    PlanificadorEventos planificador;
+
+    std::ifstream parametros;
+    std::ofstream resultados;
+
+    /**
+     * @brief Lee la descripción de la red desde el archivo de parámetros y la valida.
+     *
+     * También resuelve las ecuaciones de tráfico, de modo que una red que no es abierta se rechaza antes de simular.
+     */
+    void leerParametros() {
+        parametros >> numEstaciones >> numEsperasRequerido >> semilla;
+        if (!parametros || numEstaciones <= 0) {
+            throw std::runtime_error("Archivo de parametros de la red invalido");
+        }
+        if (semilla < 1 || semilla > MAX_SEMILLA) {
+            throw std::runtime_error("La semilla debe estar entre 1 y " + std::to_string(MAX_SEMILLA));
+        }
+
+        mediaEntreLlegadas.resize(numEstaciones);
+        mediaServicio.resize(numEstaciones);
+        for (int i = 0; i < numEstaciones; ++i) {
+            parametros >> mediaEntreLlegadas[i] >> mediaServicio[i];
+        }
+
+        enrutamiento.assign(numEstaciones, std::vector<double>(numEstaciones));
+        destinos.assign(numEstaciones, std::vector<int>());
+        probAcumulada.assign(numEstaciones, std::vector<double>());
+        for (int i = 0; i < numEstaciones; ++i) {
+            double acumulada = 0.0;
+            for (int j = 0; j < numEstaciones; ++j) {
+                parametros >> enrutamiento[i][j];
+                if (enrutamiento[i][j] < 0.0) {
+                    throw std::runtime_error("La matriz de enrutamiento tiene probabilidades negativas");
+                }
+                if (enrutamiento[i][j] > 0.0) {
+                    acumulada += enrutamiento[i][j];
+                    destinos[i].push_back(j);
+                    probAcumulada[i].push_back(acumulada);
+                }
+            }
+            if (acumulada > 1.0 + 1.0e-9) {
+                throw std::runtime_error("Una fila de la matriz de enrutamiento suma mas de 1");
+            }
+        }
+
+        if (!parametros) {
+            throw std::runtime_error("Archivo de parametros de la red incompleto");
+        }
+
+        std::vector<double> tasasExternas(numEstaciones);
+        for (int i = 0; i < numEstaciones; ++i) {
+            tasasExternas[i] = mediaEntreLlegadas[i] > 0.0 ? 1.0 / mediaEntreLlegadas[i] : 0.0;
+        }
+        tasasEfectivas = TasasEfectivasJackson(tasasExternas, enrutamiento);
+    }
+
+    /**
+     * @brief Inicializa la simulación.
+     *
+     * Reinicia el estado de las estaciones y programa la primera llegada externa de cada estación que las recibe.
+     */
+    void inicializar() {
+        tiempoSimulacion = 0.0;
+        numEsperasTotal = 0;
+        estaciones.inicializar();
+
+        for (int i = 0; i < numEstaciones; ++i) {
+            if (mediaEntreLlegadas[i] > 0.0) {
+                planificador.programar(tiempoSimulacion + exponencial(mediaEntreLlegadas[i]), EVENTO_LLEGADA, i);
+            }
+        }
+    }
+
+    /**
+     * @brief Extrae el siguiente evento de la lista compartida y adelanta el reloj de la simulación.
+     */
+    Evento temporizador() {
+        if (planificador.vacio()) {
+            resultados << "\nLista de Eventos vacia en el instante: " << tiempoSimulacion;
+            exit(1);
+        }
+
+        Evento evento = planificador.siguiente();
+        tiempoSimulacion = evento.tiempo;
+        return evento;
+    }
+
+    /**
+     * @brief Lleva un cliente a una estación y programa su salida si inicia servicio.
+     *
+     * @param estacion La estación a la que llega el cliente.
+     */
+    void llegada(int estacion) {
+        int antes = estaciones.numClientesEsperando[estacion];
+        if (estaciones.llegada(estacion, tiempoSimulacion)) {
+            planificador.programar(tiempoSimulacion + exponencial(mediaServicio[estacion]), EVENTO_SALIDA, estacion);
+        }
+        numEsperasTotal += estaciones.numClientesEsperando[estacion] - antes;
+    }
+
+    /**
+     * @brief Gestiona una llegada externa y programa la siguiente llegada externa a la misma estación.
+     *
+     * @param estacion La estación que recibe la llegada.
+     */
+    void llegadaExterna(int estacion) {
+        planificador.programar(tiempoSimulacion + exponencial(mediaEntreLlegadas[estacion]), EVENTO_LLEGADA, estacion);
+        llegada(estacion);
+    }
+
+    /**
+     * @brief Gestiona la salida de un cliente y lo enruta a la siguiente estación o fuera de la red.
+     *
+     * @param estacion La estación de la que sale el cliente.
+     */
+    void salida(int estacion) {
+        int antes = estaciones.numClientesEsperando[estacion];
+        if (estaciones.salida(estacion, tiempoSimulacion)) {
+            planificador.programar(tiempoSimulacion + exponencial(mediaServicio[estacion]), EVENTO_SALIDA, estacion);
+        }
+        numEsperasTotal += estaciones.numClientesEsperando[estacion] - antes;
+
+        int destino = enrutar(estacion);
+        if (destino >= 0) {
+            llegada(destino);
+        }
+    }
+
+    /**
+     * @brief Elige el destino de un cliente que sale de una estación.
+     *
+     * @param estacion La estación de la que sale el cliente.
+     * @return La estación destino, o -1 si el cliente abandona la red.
+     */
+    int enrutar(int estacion) {
+        const std::vector<double> &acumulada = probAcumulada[estacion];
+        if (acumulada.empty()) {
+            return -1;
+        }
+
+        double u = LCGrand(semilla);
+        auto it = std::upper_bound(acumulada.begin(), acumulada.end(), u);
+        if (it == acumulada.end()) {
+            return -1;
+        }
+        return destinos[estacion][it - acumulada.begin()];
+    }
+
+    /**
+     * @brief Genera informes.
+     *
+     * Imprime, para cada estación, la utilización, el número promedio en cola y la demora promedio simulados junto
+     * a los valores teóricos de la red de Jackson.
+     */
+    void reporte() {
+        resultados << "\n\n";
+        resultados << "=============================================\n";
+        resultados << "|| Resultado de la Simulacion\n";
+        resultados << "=============================================\n";
+        resultados << "|| Demoras completadas:                    " << std::setw(10) << numEsperasTotal << " clientes.\n";
+        resultados << "|| Simulacion terminada a los:             " << std::setw(10) << tiempoSimulacion << " minutos.\n";
+        resultados << "=============================================\n";
+        resultados << "|| Comparacion por estacion (simulado / Jackson)\n";
+        resultados << "=============================================\n";
+        resultados << "Estacion , Tasa efectiva , Uso sim , Uso teo , Cola sim , Cola teo , Demora sim , Demora teo\n";
+
+        for (int i = 0; i < numEstaciones; ++i) {
+            estaciones.actEstadisticasTiempoProm(i, tiempoSimulacion);
+
+            double utilizacion = tasasEfectivas[i] * mediaServicio[i];
+            double demoraSimulada = estaciones.numClientesEsperando[i] > 0
+                                    ? estaciones.totalDeEsperas[i] / estaciones.numClientesEsperando[i] : 0.0;
+
+            resultados << i + 1 << " , "
+                       << tasasEfectivas[i] << " , "
+                       << estaciones.areaEstadoServidor[i] / tiempoSimulacion << " , "
+                       << utilizacion << " , "
+                       << estaciones.areaNumEnCola[i] / tiempoSimulacion << " , "
+                       << ColaPromedioJackson(utilizacion) << " , "
+                       << demoraSimulada << " , "
+                       << DemoraPromedioJackson(tasasEfectivas[i], utilizacion) << "\n";
+        }
+        resultados << "=============================================\n";
+    }
+
+    /**
+     * @brief Devuelve una variable aleatoria exponencial.
+     *
+     * @param media El valor medio para la distribución exponencial.
+     * @return Una variable aleatoria exponencial.
+     */
+    double exponencial(double media) {
+        return -media * std::log(LCGrand(semilla));
+    }
+
+    /**
+     * @brief Cierra recursos abiertos
+     */
+    void limpieza() {
+        if (parametros.is_open()) {
+            parametros.close();
+        }
+        if (resultados.is_open()) {
+            resultados.close();
+        }
+    }
+
+public:
+
+    /**
+     * @brief El constructor de SimulacionRedJackson.
+     *
+     * Este constructor lee la descripción de la red y escribe el encabezado del reporte.
+     */
+    SimulacionRedJackson() : numEstaciones(0), numEsperasRequerido(0), numEsperasTotal(0), semilla(0),
+                             tiempoSimulacion(0.0), estaciones(0) {
+        parametros.open(PARAMS_RED_ABS_PATH);
+        resultados.open(REPORT_RED_ABS_PATH);
+
+        leerParametros();
+        estaciones = EstacionesMM1(numEstaciones);
+
+        resultados << "=============================================\n";
+        resultados << "|| Red de Colas de Jackson (estaciones M/M/1)\n";
+        resultados << "=============================================\n";
+        resultados << "|| Numero de estaciones:   " << std::setw(10) << numEstaciones << " estaciones.\n";
+        resultados << "|| Numero de demoras:      " << std::setw(10) << numEsperasRequerido << " clientes.\n";
+        resultados << "|| Valor de la semilla:    " << std::setw(10) << semilla << "\n";
+        resultados << "=============================================\n";
+    }
+
+    /**
+     * @brief Ejecuta la simulación.
+     *
+     * Este método inicializa la red y la ejecuta hasta completar el número de demoras requerido sumando todas las
+     * estaciones. Finalmente, genera informes.
+     */
+    void ejecutar() {
+        inicializar();
+
+        while (numEsperasTotal < numEsperasRequerido) {
+            Evento evento = temporizador();
+
+            switch (evento.tipo) {
+                case EVENTO_LLEGADA:
+                    llegadaExterna(evento.estacion);
+                    break;
+                case EVENTO_SALIDA:
+                    salida(evento.estacion);
+                    break;
+            }
+        }
+
+        reporte();
+        limpieza();
+    }
+
+};
+
+int main() {
+    try {
+        SimulacionRedJackson simulacionRed;
+        simulacionRed.ejecutar();
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 3;
+    }
+    return 0;
+}
@@ -1,7 +1,8 @@
 /**
  * @archivo erlangf.cpp
  * @fecha 14/06/2024
- * @brief Este archivo contiene la implementación de fórmulas Erlang B y C y una función factorial.
+ * @brief Este archivo contiene la implementación de fórmulas Erlang B y C, una función factorial y las medidas de
+ * desempeño teóricas de la cola M/M/1.
  */
  
 #include <cmath>
@@ -74,3 +75,29 @@ double ErlangC(int m, double tasaLlegadas, double tasaServicio){
 
     return upper / lower;
 };
+
+/**
+ * @brief Calcula el número promedio teórico de clientes en la cola de un sistema M/M/1.
+ *
+ * @param mediaEntreLlegadas El tiempo medio entre llegadas.
+ * @param mediaServicio El tiempo medio de servicio.
+ * @return El número promedio en cola rho^2 / (1 - rho), o infinito si el sistema es inestable.
+ */
+double ColaPromedioMM1(double mediaEntreLlegadas, double mediaServicio) {
+    double utilizacion = mediaServicio / mediaEntreLlegadas;
+    if (utilizacion >= 1.0) {
+        return INFINITY;
+    }
+    return utilizacion * utilizacion / (1.0 - utilizacion);
+}
+
+/**
+ * @brief Calcula la demora promedio teórica en la cola de un sistema M/M/1 usando la ley de Little.
+ *
+ * @param mediaEntreLlegadas El tiempo medio entre llegadas.
+ * @param mediaServicio El tiempo medio de servicio.
+ * @return La demora promedio en cola, o infinito si el sistema es inestable.
+ */
+double DemoraPromedioMM1(double mediaEntreLlegadas, double mediaServicio) {
+    return ColaPromedioMM1(mediaEntreLlegadas, mediaServicio) * mediaEntreLlegadas;
+}
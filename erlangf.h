@@ -7,5 +7,7 @@
 
 double ErlangB(int m, double tasaLlegadas, double tasaServicio);
 double ErlangC(int m, double tasaLlegadas, double tasaServicio);
+double ColaPromedioMM1(double mediaEntreLlegadas, double mediaServicio);
+double DemoraPromedioMM1(double mediaEntreLlegadas, double mediaServicio);
 
 #endif //METALLER2_ERLANGF_H
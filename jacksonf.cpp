@@ -0,0 +1,97 @@
+/**
+ * @archivo jacksonf.cpp
+ * @brief Este archivo contiene los valores teóricos de forma producto de una red abierta de Jackson.
+ *
+ * En una red de Jackson cada estación se comporta como una cola M/M/1 independiente cuya tasa de llegadas es la
+ * tasa efectiva que resulta de las ecuaciones de tráfico.
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "erlangf.h"
+#include "jacksonf.h"
+
+/**
+ * @brief Resuelve las ecuaciones de tráfico de una red abierta de Jackson.
+ *
+ * Calcula las tasas efectivas de llegada que satisfacen lambda_j = gamma_j + suma_i lambda_i * P_ij mediante
+ * eliminación gaussiana con pivoteo parcial sobre el sistema (I - P^T) lambda = gamma.
+ *
+ * @param tasasExternas Las tasas de llegadas externas gamma de cada estación.
+ * @param enrutamiento La matriz de enrutamiento P, donde P[i][j] es la probabilidad de ir de i a j.
+ * @return Las tasas efectivas de llegada de cada estación.
+ */
+std::vector<double> TasasEfectivasJackson(const std::vector<double> &tasasExternas,
+                                          const std::vector<std::vector<double>> &enrutamiento) {
+    const int n = static_cast<int>(tasasExternas.size());
+    std::vector<std::vector<double>> a(n, std::vector<double>(n + 1));
+
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            a[j][i] = (i == j ? 1.0 : 0.0) - enrutamiento[i][j];
+        }
+        a[j][n] = tasasExternas[j];
+    }
+
+    for (int k = 0; k < n; ++k) {
+        int pivote = k;
+        for (int i = k + 1; i < n; ++i) {
+            if (std::fabs(a[i][k]) > std::fabs(a[pivote][k])) {
+                pivote = i;
+            }
+        }
+        if (std::fabs(a[pivote][k]) < 1.0e-12) {
+            throw std::runtime_error("Las ecuaciones de trafico no tienen solucion unica: la red no es abierta");
+        }
+        std::swap(a[k], a[pivote]);
+
+        for (int i = k + 1; i < n; ++i) {
+            double factor = a[i][k] / a[k][k];
+            if (factor == 0.0) {
+                continue;
+            }
+            for (int c = k; c <= n; ++c) {
+                a[i][c] -= factor * a[k][c];
+            }
+        }
+    }
+
+    std::vector<double> tasas(n);
+    for (int i = n - 1; i >= 0; --i) {
+        double suma = a[i][n];
+        for (int c = i + 1; c < n; ++c) {
+            suma -= a[i][c] * tasas[c];
+        }
+        tasas[i] = suma / a[i][i];
+    }
+    return tasas;
+}
+
+/**
+ * @brief Calcula el número promedio de clientes en la cola de una estación M/M/1.
+ *
+ * Solo depende de la utilización, así que se evalúa ColaPromedioMM1 con tiempos medidos en unidades del tiempo
+ * medio entre llegadas.
+ *
+ * @param utilizacion La utilización rho de la estación.
+ * @return El número promedio en cola, o infinito si la estación es inestable.
+ */
+double ColaPromedioJackson(double utilizacion) {
+    return ColaPromedioMM1(1.0, utilizacion);
+}
+
+/**
+ * @brief Calcula la demora promedio en la cola de una estación M/M/1 usando la ley de Little.
+ *
+ * @param tasaEfectiva La tasa efectiva de llegadas a la estación.
+ * @param utilizacion La utilización rho de la estación.
+ * @return La demora promedio en cola.
+ */
+double DemoraPromedioJackson(double tasaEfectiva, double utilizacion) {
+    if (tasaEfectiva <= 0.0) {
+        return 0.0;
+    }
+    return ColaPromedioJackson(utilizacion) / tasaEfectiva;
+}
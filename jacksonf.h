@@ -0,0 +1,11 @@
+#ifndef METALLER2_JACKSONF_H
+#define METALLER2_JACKSONF_H
+
+#include <vector>
+
+std::vector<double> TasasEfectivasJackson(const std::vector<double> &tasasExternas,
+                                          const std::vector<std::vector<double>> &enrutamiento);
+double ColaPromedioJackson(double utilizacion);
+double DemoraPromedioJackson(double tasaEfectiva, double utilizacion);
+
+#endif //METALLER2_JACKSONF_H
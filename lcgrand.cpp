@@ -9,6 +9,9 @@
 #define MODULUS 2147483647 /**< Límite superior en el rango de números que se pueden generar */
 #define MULT1 24112 /**< Multiplicador utilizado en la generación del siguiente número aleatorio */
 #define MULT2 26143 /**< Segundo multiplicador utilizado en la generación del siguiente número aleatorio */
+#define SEMILLA_FLUJOS 1973272912 /**< Estado inicial del flujo 1, desde el cual se ubican los flujos por réplica */
+
+#include "lcgrand.h"
 
 /* Matriz de semillas para los primeros 100 números */
 long zrng[] = {
@@ -32,6 +35,9 @@ long zrng[] = {
         364849192, 2049576050, 638580085, 547070247
 };
 
+/* Cantidad de números generados por cada flujo desde su última ubicación con LCGrandFlujo */
+long long zrngUsados[sizeof(zrng) / sizeof(zrng[0])];
+
 /**
  * @brief Genera el siguiente número pseudoaleatorio
  *
@@ -58,6 +64,42 @@ float LCGrand(int num) {
     if (zi < 0) { zi += MODULUS; }
 
     zrng[num] = zi;
+    ++zrngUsados[num];
 
     return static_cast<float>((zi >> 7 | 1) / 16777216.0);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Ubica un flujo al inicio de un segmento disjunto de la secuencia del generador.
+ *
+ * Cada llamada a LCGrand multiplica el estado por MULT1 * MULT2 módulo MODULUS, así que avanzar k números equivale a
+ * multiplicar el estado por (MULT1 * MULT2)^k. El segmento s comienza s * LONGITUD_FLUJO números después de
+ * SEMILLA_FLUJOS, de modo que los segmentos 1 a MAX_FLUJOS no se traslapan entre sí siempre que ninguno genere más
+ * de LONGITUD_FLUJO números.
+ *
+ * @param num Índice en la matriz semilla que usará el segmento
+ * @param flujo El número de segmento, entre 1 y MAX_FLUJOS
+ */
+void LCGrandFlujo(int num, long long flujo) {
+    unsigned long long estado = SEMILLA_FLUJOS;
+    unsigned long long base = (static_cast<unsigned long long>(MULT1) * MULT2) % MODULUS;
+
+    for (unsigned long long pasos = static_cast<unsigned long long>(flujo) * LONGITUD_FLUJO; pasos > 0; pasos >>= 1) {
+        if (pasos & 1) {
+            estado = (estado * base) % MODULUS;
+        }
+        base = (base * base) % MODULUS;
+    }
+
+    zrng[num] = static_cast<long>(estado);
+    zrngUsados[num] = 0;
+}
+
+/**
+ * @brief Devuelve cuántos números ha generado un flujo desde su última ubicación con LCGrandFlujo.
+ *
+ * @param num Índice en la matriz semilla
+ */
+long long LCGrandUsados(int num) {
+    return zrngUsados[num];
+}
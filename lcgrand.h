@@ -5,4 +5,9 @@
 extern long zrng[];  // Declare zrng array
 float LCGrand(int num);  // Declare LCGrand function
 
+constexpr long long LONGITUD_FLUJO = 1048576;  // Numeros disponibles por flujo de replica (2^20)
+constexpr long long MAX_FLUJOS = 2046;  // Flujos de replica disjuntos dentro del periodo del generador
+void LCGrandFlujo(int num, long long flujo);  // Ubica un flujo al inicio del segmento de una replica
+long long LCGrandUsados(int num);  // Numeros generados por un flujo desde su ubicacion
+
 #endif //METALLER2_LCGRAND_H
\ No newline at end of file